@@ -0,0 +1,71 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <vector>
+
+using namespace std;
+
+
+// Word-aligned hybrid (WAH) encoding: the bits are taken in groups of
+// 31. A literal word (top bit clear) holds one group as is; a fill
+// word (top bit set) stands for a run of groups that are all zeros or
+// all ones, with the fill value in bit 30 and the run length in the
+// low 30 bits.
+
+const unsigned WAHGROUP = 31;           // bits per group
+const unsigned WAHFILL = 0x80000000;    // word is a fill
+const unsigned WAHONES = 0x40000000;    // fill of ones
+const unsigned WAHRUN = 0x3fffffff;     // run length of a fill
+const unsigned WAHALL = 0x7fffffff;     // group with all bits set
+
+
+// A WAH compressed bitmap. Runs of zeros (and ones) cost one word, so
+// the bitmap of a value that occurs in few records stays small, and
+// AND, OR and AND NOT work on the compressed words a run at a time.
+// Bits past the last group are zero.
+
+class Bitmap {
+ public:
+  Bitmap();
+
+  // set or clear bit pos; setting bits in increasing order appends
+  void set(const unsigned pos);
+  void clear(const unsigned pos);
+
+  // number of bits set
+  unsigned count() const;
+
+  // true if no bit is set
+  bool empty() const;
+
+  // append the positions of the set bits, in increasing order, to out
+  void positions(vector<unsigned> & out) const;
+
+  // bitwise combinations
+  Bitmap operator&(const Bitmap & other) const;
+  Bitmap operator|(const Bitmap & other) const;
+  Bitmap andNot(const Bitmap & other) const;
+
+  // the compressed words, for storing the bitmap and reading it back
+  const vector<unsigned> & getWords() const { return words; }
+  void setWords(const unsigned *w, const int wordCnt);
+
+ private:
+  vector<unsigned> words;               // compressed bits
+  unsigned groups;                      // # of groups the words cover
+
+  // append n groups of value (a literal, or 0 or WAHALL for a fill)
+  void append(const unsigned value, unsigned n);
+
+  // drop trailing fills of zeros
+  void trim();
+
+  // replace word i, a fill, by a fill of before groups, the literal
+  // value and a fill of after groups
+  void splitFill(const int i, const unsigned before,
+                 const unsigned value, const unsigned after);
+
+  static Bitmap combine(const Bitmap & a, const Bitmap & b, const int op);
+};
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef BITMAPINDEX_H
+#define BITMAPINDEX_H
+
+#include "heapfile.h"
+#include "bitmap.h"
+
+
+const int BMSLOTS = 256;                // bound on the slots of a page: a
+                                        // record takes its slot plus a
+                                        // byte at least
+const int BMMAXVALUES = 256;            // most distinct values a bitmap
+                                        // index is built for
+
+
+// A record is bit pageNo * BMSLOTS + slotNo of the bitmaps, so that
+// the set bits of a bitmap come out in file order.
+
+inline unsigned BM_RidToPos(const RID & rid)
+{
+  return (unsigned) rid.pageNo * BMSLOTS + rid.slotNo;
+}
+
+inline RID BM_PosToRid(const unsigned pos)
+{
+  RID rid;
+  rid.pageNo = pos / BMSLOTS;
+  rid.slotNo = pos % BMSLOTS;
+  return rid;
+}
+
+
+// Contents of the first page of a bitmap index file. The distinct
+// values and their compressed bitmaps are stored one after another as
+// (key, word count, words) in a chain of data pages starting at
+// dataPage.
+
+typedef struct {
+  int keyLen;                           // length of key in bytes
+  int keyType;                          // Datatype of key
+  int valueCnt;                         // number of distinct values
+  int byteCnt;                          // bytes stored in data pages
+  int dataPage;                         // first data page, -1 if none
+} BMMETA;
+
+
+// Header at the front of every data page.
+
+typedef struct {
+  int next;                             // next data page, -1 if none
+} BMDATA;
+
+const int BMDATASIZE = PAGESIZE - sizeof(BMDATA);
+
+
+// A bitmap index on one attribute of a relation: one compressed bitmap
+// of the records per distinct value. Meant for attributes with few
+// distinct values, where the bitmaps are small enough to be read into
+// memory when the index is opened; they are written back when it is
+// closed. Predicates on several indexed attributes are answered by
+// combining bitmaps.
+
+class BitmapIndex {
+ public:
+  // open an existing index and read its bitmaps
+  BitmapIndex(const string & indexName, Status & status);
+
+  // write back the bitmaps if they changed, and close the index
+  ~BitmapIndex();
+
+  // create an empty index on keys of the given length and type
+  static const Status create(const string & indexName,
+                             const int keyLen, const Datatype type);
+
+  // destroy an index file
+  static const Status destroy(const string & indexName);
+
+  // add (key, rid) to the index
+  const Status insertEntry(const char* key, const RID & rid);
+
+  // remove (key, rid) from the index
+  const Status deleteEntry(const char* key, const RID & rid);
+
+  // return in result the records whose key satisfies (key op value)
+  void lookup(const char* value, const Operator op, Bitmap & result) const;
+
+  // return in result all records of the relation
+  void all(Bitmap & result) const;
+
+  // return number of distinct values in the index
+  const int getValueCnt() const;
+
+ private:
+  File* file;                           // index file
+  int metaPageNo;                       // page number of meta page
+  bool dirty;                           // true if a bitmap changed
+
+  int keyLen;                           // length of key
+  Datatype type;                        // type of key
+  vector<char> keys;                    // distinct values, in order
+  vector<Bitmap> maps;                  // bitmap of each value
+
+  // position of key in keys[], or where it would be inserted
+  int find(const char* key, bool & found) const;
+
+  // write the values and bitmaps to the data pages
+  const Status write();
+};
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <vector>
+#include "heapfile.h"
+
+using namespace std;
+
+
+// Blocked Bloom filter: each key sets BLOOMPROBES bits of a single
+// block of BLOOMBLOCKBITS bits, one cache line, chosen by its hash, so
+// that adding or testing a key touches one cache line. With
+// BLOOMBITSPERKEY bits per expected key about 1% of the keys not
+// added are taken for members.
+
+const int BLOOMBLOCKBITS = 512;         // bits of a block
+const int BLOOMBITSPERKEY = 10;         // bits per expected key
+const int BLOOMPROBES = 6;              // bits set per key
+const unsigned BLOOMWORDS = BLOOMBLOCKBITS / 32;    // words of a block
+
+// A filter that passes more than BLOOMUSEFUL percent of the first
+// BLOOMSAMPLE keys it tests costs more than it saves, and passes the
+// rest of the keys untested.
+
+const int BLOOMSAMPLE = 10000;
+const int BLOOMUSEFUL = 90;
+
+
+class BloomFilter {
+ public:
+  // keyCnt keys of type type and length keyLen are expected
+  BloomFilter(const int keyCnt, const Datatype type, const int keyLen);
+
+  void add(const char *key);
+
+  // false if key was never added; true if it was, and for a few keys
+  // that were not
+  bool mayContain(const char *key) const;
+
+  // keys given to mayContain() and how many of them passed; false
+  // once the filter has stopped testing them
+  int getProbes() const { return probes; }
+  int getPasses() const { return passes; }
+  bool isTesting() const { return testing; }
+
+ private:
+  Datatype type;
+  int keyLen;
+  unsigned blockCnt;
+  vector<unsigned> words;               // blockCnt blocks
+  mutable int probes;
+  mutable int passes;
+  mutable bool testing;
+
+  // first word of the block of a key with hash h
+  unsigned blockOf(const unsigned long long h) const
+  {
+    return ((h >> 32) * blockCnt >> 32) * BLOOMWORDS;
+  }
+
+  // 64 bit hash of a key; equal keys (0.0 and -0.0, strings up to
+  // their null) hash alike
+  unsigned long long hash(const char *key) const;
+};
+
+#endif
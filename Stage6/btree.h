@@ -0,0 +1,127 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "heapfile.h"
+#include "sort.h"
+
+
+// define if debug output wanted
+//#define DEBUGBTREE
+
+
+// Contents of the first page of an index file. The nodes of the
+// tree live in the other pages of the file.
+
+typedef struct {
+  int root;                             // page number of root node
+  int height;                           // number of levels, 1 if root is a leaf
+  int keyLen;                           // length of key in bytes
+  int keyType;                          // Datatype of key
+  int entryCnt;                         // number of (key, RID) entries
+} BTMETA;
+
+
+// Header at the front of every node page. A leaf holds count
+// (key, RID) entries. An internal node holds a child page number
+// followed by count (key, child page number) pairs; the keys of the
+// subtree of a child are >= the key before it and <= the key after it.
+
+typedef struct {
+  int level;                            // 0 for leaves
+  int count;                            // number of entries in node
+  int next;                             // right sibling, -1 if none
+} BTNODE;
+
+
+const int BTLEAFFILL = 90;              // % of a leaf filled by bulk loading
+const int BTSORTITEMS = 50000;          // records sorted in memory when
+                                        // an index is bulk loaded
+
+
+// A B+-tree index on one attribute of a relation. Duplicate keys are
+// allowed; entries with equal keys are kept in insertion order. Nodes
+// are pages of the index file and are accessed through the buffer
+// manager. Deleted entries are removed from their leaf but nodes are
+// never merged, so a leaf may become empty.
+
+class BTreeIndex {
+ public:
+  // open an existing index
+  BTreeIndex(const string & indexName, Status & status);
+  ~BTreeIndex();
+
+  // create an empty index on keys of the given length and type
+  static const Status create(const string & indexName,
+                             const int keyLen, const Datatype type);
+
+  // destroy an index file
+  static const Status destroy(const string & indexName);
+
+  // add (key, rid) to the index
+  const Status insertEntry(const char* key, const RID & rid);
+
+  // remove (key, rid) from the index
+  const Status deleteEntry(const char* key, const RID & rid);
+
+  // fill an empty index from records that consist of a key followed
+  // by a RID, delivered in key order
+  const Status bulkLoad(SortedFile & entries);
+
+  // start a scan for the entries whose key satisfies "key op value";
+  // op must not be NE
+  const Status startScan(const char* value, const Operator op);
+
+  // return the RID of the next entry of the scan, or NOMORERECS
+  const Status scanNext(RID & outRid);
+
+  // terminate the scan
+  const Status endScan();
+
+  // return number of entries in the index
+  const int getEntryCnt() const;
+
+ private:
+  File* file;                           // index file
+  int metaPageNo;                       // page number of meta page
+  BTMETA* meta;                         // pinned meta page
+  bool metaDirty;                       // true if meta page was updated
+
+  int keyLen;                           // length of key
+  Datatype type;                        // type of key
+  int leafCap;                          // max. entries in a leaf
+  int nodeCap;                          // max. keys in an internal node
+
+  // scan state
+  int scanPageNo;                       // leaf being scanned, -1 if none
+  Page* scanPage;                       // pinned leaf being scanned
+  int scanPos;                          // next entry of scanPage
+  const char* scanValue;                // comparison value of scan
+  Operator scanOp;                      // comparison operator of scan
+
+  // location of entries within node pages
+  char* leafKey(Page* node, const int i) const;
+  char* nodeKey(Page* node, const int i) const;
+  int getChild(Page* node, const int i) const;
+  void setChild(Page* node, const int i, const int child);
+
+  // compare key with key of entry i of leaf or internal node
+  int keyCompare(const char* key, const char* entryKey) const;
+
+  // index of first key in node that is > key (upper) or >= key
+  int searchNode(Page* node, const char* key, const bool upper) const;
+
+  // descend to the leftmost leaf that may hold key
+  const Status findLeaf(const char* key, int & pageNo);
+
+  // insert (key, rid) into the subtree rooted at pageNo; if the
+  // node splits, the new right node and its separator are returned
+  const Status insertInto(const int pageNo, const char* key,
+                          const RID & rid, bool & split,
+                          char* upKey, int & upPageNo);
+
+  // locate entry (key, rid), leaving its leaf pinned
+  const Status findEntry(const char* key, const RID & rid,
+                         int & pageNo, Page* & page, int & pos);
+};
+
+#endif
@@ -136,6 +136,13 @@ public:
   {
 	bufStats.clear();
   }
+
+  const int getNumBufs() const // number of pages in the buffer pool
+  {
+	return numBufs;
+  }
+
+  const int getFreeFrames() const; // number of pages not pinned
 };
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef CATALOG_H
 #define CATALOG_H
 
+#include <unordered_map>
 #include "heapfile.h"
 
 
@@ -10,6 +11,7 @@
 
 #define RELCATNAME   "relcat"           // name of relation catalog
 #define ATTRCATNAME  "attrcat"          // name of attribute catalog
+#define STATCATNAME  "statcat"          // name of statistics catalog
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
 
@@ -25,6 +27,15 @@ typedef struct {
 } RelDesc;
 
 
+// A catalog tuple as kept in the catalog caches, with its RID so that
+// it can be updated or removed without searching the catalog.
+
+typedef struct {
+  RelDesc desc;
+  RID rid;
+} RelEntry;
+
+
 typedef struct {
   char relName[MAXNAME];                // relation name
   char attrName[MAXNAME];               // attribute name
@@ -48,10 +59,12 @@ class RelCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation);
 
-  // create a new relation
+  // create a new relation, kept ordered on clusterAttr if that is
+  // not empty
   const Status createRel(const string & relation, 
 		   const int attrCnt, 
-		   const attrInfo attrList[]);
+		   const attrInfo attrList[],
+		   const string & clusterAttr = "");
 
   // destroy a relation
   const Status destroyRel(const string & relation);
@@ -61,6 +74,9 @@ class RelCatalog : public HeapFile {
 
   // get rid of catalog
   ~RelCatalog();
+
+ private:
+  unordered_map<string, RelEntry> cache;  // all tuples, by relName
 };
 
 
@@ -70,6 +86,12 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   index flags : integer(4)
+
+
+#define BTREEINDEX   1                  // attribute has a B+-tree index
+#define HASHINDEX    2                  // attribute has a hash index
+#define BITMAPINDEX  4                  // attribute has a bitmap index
 
 
 typedef struct {
@@ -78,9 +100,16 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int indexed;                          // index flags, 0 if not indexed
 } AttrDesc;
 
 
+typedef struct {
+  AttrDesc desc;
+  RID rid;
+} AttrEntry;
+
+
 class AttrCatalog : public HeapFile {
  friend class RelCatalog;
 
@@ -104,11 +133,26 @@ class AttrCatalog : public HeapFile {
 			  int &attrCnt, 
 			  AttrDesc *&attrs);
 
+  // set the index flags of an attribute
+  const Status setIndexed(const string & relation,
+                          const string & attrName, const int indexed);
+
   // delete all information about a relation
   const Status dropRelation(const string & relation);
 
+  // return a number that changes whenever the attributes of the
+  // relation change, 0 if the relation does not exist
+  const int getVersion(const string & relation) const;
+
   // close attribute catalog
   ~AttrCatalog();
+
+ private:
+  unordered_map<string, vector<AttrEntry> > cache;
+                                        // tuples of each relation, in
+                                        // catalog order
+  unordered_map<string, int> versions;  // version of each relation
+  int clock;                            // last version handed out
 };
 
 
@@ -117,5 +161,6 @@ extern AttrCatalog *attrCat;
 extern Error error;
 extern Status createHeapFile(const string filename);
 extern Status destroyHeapFile(const string filename);
+extern Status truncateHeapFile(const string filename);
 
 #endif
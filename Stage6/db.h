@@ -23,11 +23,15 @@ class File {
  public:
 
   Status allocatePage(int& pageNo);     // allocate a new page
+  Status allocatePages(const int count,
+		       int& firstPageNo);   // extend file by count pages
   const Status disposePage(const int pageNo);       // release space for a page
   const Status readPage(const int pageNo,
 		  Page* pagePtr) const;       // read page from file
   const Status writePage(const int pageNo,
 		   const Page* pagePtr);      // write page to file
+  const Status writePages(const int firstPageNo, const int count,
+		    const Page* pages);       // write run of pages to file
   const Status getFirstPage(int& pageNo) const;     // returns pageNo of first page
 
   bool operator == (const File & other) const
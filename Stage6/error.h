@@ -45,13 +45,14 @@ enum Status {
 
        BADCATPARM, RELNOTFOUND, ATTRNOTFOUND,
        NAMETOOLONG, DUPLATTR, RELEXISTS, NOINDEX,
-       INDEXEXISTS, ATTRTOOLONG,
+       INDEXEXISTS, ATTRTOOLONG, NOSTATS,
 
 // Utility errors
 
 // Query errors
 
-       ATTRTYPEMISMATCH, TMP_RES_EXISTS,
+       ATTRTYPEMISMATCH, TMP_RES_EXISTS, TOOMANYRELS, NOTGROUPED,
+       SUMOVERFLOW,
 
 // do not touch filler -- add codes before it
 
@@ -0,0 +1,291 @@
+#ifndef EXEC_H
+#define EXEC_H
+
+#include <vector>
+#include <unordered_map>
+#include "query.h"
+#include "joinHT.h"
+
+using namespace std;
+
+class VecIter;
+
+
+// Pipelined query execution. A query plan is a tree of iterators, each
+// handing its parent the records of its result one at a time: open()
+// gets an iterator ready, next() returns its next record, or FILEEOF
+// once there are no more, and close() releases what open() took. A
+// record returned by next() stays valid until the following call of
+// next() or close(). The attributes of the records are described by
+// the schema of the iterator, whose offsets are into them.
+//
+// An iterator produces a record as soon as its inputs do, except for
+// the pipeline breakers, which read all of an input in open() before
+// they return anything: the inner input of a join, which is held in
+// memory, and the input of a sort or of an aggregation. Nothing is
+// written to a file on the way.
+
+class Iterator {
+ public:
+  virtual ~Iterator() {}
+
+  virtual const Status open() = 0;
+  virtual const Status next(Record & rec) = 0;
+  virtual const Status close() = 0;
+
+  const vector<AttrDesc> & getSchema() const { return schema; }
+  int getRecLen() const { return reclen; }
+
+  // position of an attribute in the schema, -1 if it is not there
+  int find(const char *relName, const char *attrName) const;
+
+  // the same plan run on batches of columns (see vexec.h), producing
+  // the attributes i of the schema with needed[i] set; colOf[i] gets
+  // the column of attribute i in the batches, -1 if it is left out
+  virtual VecIter *vectorize(const vector<bool> & needed,
+                             vector<int> & colOf,
+                             Status & status) const = 0;
+
+ protected:
+  vector<AttrDesc> schema;              // attributes of the records
+  int reclen;                           // bytes of a record
+};
+
+
+// A comparison of two attributes of a record, (attr1 op attr2).
+
+struct ExecPred {
+  AttrDesc attr1;
+  Operator op;
+  AttrDesc attr2;
+};
+
+// A sort key.
+
+struct ExecKey {
+  AttrDesc attr;
+  bool desc;                            // descending order
+};
+
+// An aggregate: func applied to attr.
+
+struct ExecAgg {
+  AggFunc func;
+  AttrDesc attr;
+};
+
+
+// All the records of a relation.
+
+class ScanIter : public Iterator {
+ public:
+  ScanIter(const string & relation, Status & status);
+  ~ScanIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  string relation;
+  HeapFileScan *scan;
+};
+
+
+// The records of a relation satisfying cond, a condition on it, read
+// through the indexes picked by method (see QU_CondAccess). The RIDs
+// the indexes give are collected by open(), and the records fetched in
+// file order.
+
+class IndexIter : public Iterator {
+ public:
+  IndexIter(const string & relation, const vector<CondNode> & cond,
+            const AccessMethod method, Status & status);
+  ~IndexIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  string relation;
+  vector<CondNode> cond;
+  AccessMethod method;
+  HeapFile *file;
+  vector<RID> rids;
+  bool exact;                           // all of rids satisfy cond
+  unsigned int pos;
+};
+
+
+// The records of input satisfying all of conds, conditions on the
+// attributes of input, and all of checks, comparisons of two of them.
+
+class FilterIter : public Iterator {
+ public:
+  FilterIter(Iterator *input, const vector< vector<CondNode> > & conds,
+             const vector<ExecPred> & checks);
+  ~FilterIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  Iterator *input;
+  vector< vector<CondNode> > conds;
+  vector<ExecPred> checks;
+};
+
+
+// The records of input cut down to attrs, attributes of input, in
+// that order.
+
+class ProjectIter : public Iterator {
+ public:
+  ProjectIter(Iterator *input, const vector<AttrDesc> & attrs);
+  ~ProjectIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  Iterator *input;
+  vector<AttrDesc> from;                // attrs, with offsets into input
+  vector<char> data;                    // the record returned
+};
+
+
+// Joins outer with inner: a result record is an outer record followed
+// by an inner record. The inner records joined with an outer one are
+// found by key, (attr1 op attr2) with attr1 an attribute of outer and
+// attr2 one of inner: an EQ key is looked up in a hash table on inner,
+// any other key but NE is a range of the inner records sorted on
+// attr2. Without a key every inner record is joined. checks are more
+// predicates on the result records. All of inner is read into memory
+// by open().
+
+class JoinIter : public Iterator {
+ public:
+  JoinIter(Iterator *outer, Iterator *inner, const ExecPred *key,
+           const vector<ExecPred> & checks);
+  ~JoinIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  Iterator *outer;
+  Iterator *inner;
+  bool hasKey;
+  ExecPred key;
+  vector<ExecPred> checks;
+  int outerLen, innerLen;
+
+  vector<char> resident;                // the inner records
+  vector<const char *> recs;            // sorted on the key
+  joinHashTbl *table;                   // on the key, for EQ
+  vector<RID> matches;                  // the last probe of the table
+  int pos, end;                         // inner records left to join
+  vector<char> data;                    // the record returned
+
+  const char *innerRec(const int i) const;
+};
+
+
+// The records of input ordered on keys, attributes of input. All of
+// input is read into memory by open().
+
+class SortIter : public Iterator {
+ public:
+  SortIter(Iterator *input, const vector<ExecKey> & keys);
+  ~SortIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  Iterator *input;
+  vector<ExecKey> keys;
+  vector<char> resident;
+  vector<const char *> recs;
+  unsigned int pos;
+};
+
+
+// One record per group of the records of input with the same values of
+// groups, holding those values followed by the aggregates. Without
+// groups all the records of input form one group. The groups are
+// formed by open(), in the order their first records come in.
+
+class AggIter : public Iterator {
+ public:
+  AggIter(Iterator *input, const vector<AttrDesc> & groups,
+          const vector<ExecAgg> & aggs, Status & status);
+  ~AggIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  Iterator *input;
+  vector<AttrDesc> groups;
+  vector<ExecAgg> aggs;
+  int groupLen;                         // bytes of the group values
+
+  struct Group {
+    vector<char> rec;                   // record returned
+    vector<double> sums;                // SUM and AVG of each aggregate
+    int count;                          // records in the group
+  };
+  unordered_map<string, int> index;     // position of each group
+  vector<Group> groupList;
+  unsigned int pos;
+};
+
+
+// Plan a query for QU_Pipeline; desc gets a description of the plan.
+
+const Status EX_Plan(const int projCnt,
+                     const QueryAttr projNames[],
+                     const int predCnt,
+                     const JoinPred preds[],
+                     const int condCnt,
+                     const Condition * const conds[],
+                     const int groupCnt,
+                     const QueryAttr groupNames[],
+                     const int sortCnt,
+                     const QueryAttr sortKeys[],
+                     Iterator *& plan,
+                     string & desc);
+
+// Create relation result for records of the given attributes, or check
+// that the existing one can hold them.
+
+const Status EX_Result(const string & result, const vector<AttrDesc> & schema);
+
+// Run a plan, inserting its records into relation result or printing
+// them; count gets the number of records.
+
+const Status EX_Insert(Iterator *plan, const string & result, int & count);
+const Status EX_Print(Iterator *plan, int & count);
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include "heapfile.h"
+
+
+// define if debug output wanted
+//#define DEBUGHASH
+
+
+const int HASHMAXDIRPAGES = (PAGESIZE - 5 * sizeof(int)) / sizeof(int);
+const int HASHDIRPERPAGE = PAGESIZE / sizeof(int);
+const int HASHMAXDEPTH = 15;            // 2^15 directory entries fit
+                                        // in HASHMAXDIRPAGES pages
+
+
+// Contents of the first page of a hash index file. The directory has
+// 2^globalDepth entries, each the page number of a bucket, stored
+// HASHDIRPERPAGE to a page in the pages listed in dirPages[].
+
+typedef struct {
+  int globalDepth;                      // # of hash bits used by directory
+  int keyLen;                           // length of key in bytes
+  int keyType;                          // Datatype of key
+  int entryCnt;                         // number of (key, RID) entries
+  int dirPageCnt;                       // number of directory pages
+  int dirPages[HASHMAXDIRPAGES];        // page numbers of directory pages
+} HASHMETA;
+
+
+// Header at the front of every bucket page, followed by count
+// (key, RID) entries. A bucket whose entries all have the same hash
+// value cannot be split; it grows a chain of overflow pages instead.
+
+typedef struct {
+  int localDepth;                       // # of hash bits shared by entries
+  int count;                            // number of entries in page
+  int overflow;                         // next overflow page, -1 if none
+} HASHBUCKET;
+
+
+// An extendible hash index on one attribute of a relation. The
+// directory doubles when a bucket whose local depth equals the global
+// depth overflows, and only the overflowing bucket is split, so the
+// index grows one bucket at a time without rehashing the other
+// entries. Only equality lookups are supported.
+
+class HashIndex {
+ public:
+  // open an existing index
+  HashIndex(const string & indexName, Status & status);
+  ~HashIndex();
+
+  // create an empty index on keys of the given length and type with
+  // at least nbuckets buckets
+  static const Status create(const string & indexName,
+                             const int keyLen, const Datatype type,
+                             const int nbuckets);
+
+  // destroy an index file
+  static const Status destroy(const string & indexName);
+
+  // add (key, rid) to the index
+  const Status insertEntry(const char* key, const RID & rid);
+
+  // remove (key, rid) from the index
+  const Status deleteEntry(const char* key, const RID & rid);
+
+  // start a scan for the entries whose key equals value
+  const Status startScan(const char* value);
+
+  // return the RID of the next entry of the scan, or NOMORERECS
+  const Status scanNext(RID & outRid);
+
+  // terminate the scan
+  const Status endScan();
+
+  // return number of entries in the index
+  const int getEntryCnt() const;
+
+ private:
+  File* file;                           // index file
+  int metaPageNo;                       // page number of meta page
+  HASHMETA* meta;                       // pinned meta page
+  bool metaDirty;                       // true if meta page was updated
+
+  int keyLen;                           // length of key
+  Datatype type;                        // type of key
+  int bucketCap;                        // max. entries in a bucket page
+
+  // scan state
+  int scanPageNo;                       // bucket page being scanned
+  Page* scanPage;                       // pinned bucket page, or NULL
+  int scanPos;                          // next entry of scanPage
+  const char* scanValue;                // key searched for
+
+  // hash value of a key; keys that compare equal hash alike
+  unsigned int hash(const char* key) const;
+
+  // location of entry i of a bucket page
+  char* entry(Page* bucket, const int i) const;
+
+  // read and write directory entries
+  const Status getDir(const int i, int & bucketNo);
+  const Status setDir(const int i, const int bucketNo);
+
+  // double the directory
+  const Status doubleDir();
+
+  // split the bucket that directory entry idx points to
+  const Status split(const int idx);
+
+  // fill a bucket and its overflow chain from entries[]
+  const Status writeBucket(const int pageNo, Page* bucket,
+                           const vector<char> & entries, const int count);
+};
+
+#endif
@@ -20,6 +20,10 @@ extern DB db;
 
 // Some constant definitions
 const unsigned MAXNAMESIZE = 50;
+const int BULKRUNPAGES = 64;    // pages written per I/O by bulk loading
+const int BATCHBYTES = BULKRUNPAGES * 1024; // bytes buffered by InsertBatch
+const int CLUSTERSLACK = (PAGESIZE - DPFIXED) / 5; // bytes left free per
+                                // page when a clustered file is rebuilt
 
 enum Datatype { STRING, INTEGER, FLOAT };    // attribute data types
 enum Operator { LT, LTE, EQ, GTE, GT, NE };  // scan operators
@@ -31,9 +35,25 @@ struct FileHdrPage
   int		lastPage;	// pageNo of last data page in file
   int		pageCnt;	// number of pages
   int		recCnt;		// record count
+  int		clusterOffset;	// offset of attribute the records are
+				// kept ordered on, -1 if unordered
+  int		clusterLength;	// length of that attribute
+  int		clusterType;	// type of that attribute
 };
 
 
+// Compares two attribute values of the given type and length and
+// returns a negative number, zero, or a positive number if p1 is
+// less than, equal to, or greater than p2.
+int attrCompare(const char* p1, const char* p2,
+                const int length, const Datatype type);
+
+// Orders RIDs by page and slot number; sorting the RIDs of records
+// before fetching them reads each page once.
+bool ridLess(const RID & a, const RID & b);
+
+class BloomFilter;
+
 // class definition of heapFile
 class HeapFile {
 protected:
@@ -58,8 +78,22 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // return the attribute the records are kept ordered on; offset
+  // is -1 if the file is not clustered
+  void getCluster(int& offset, int& length, Datatype& type) const;
+
+  // keep the records ordered on the given attribute from now on,
+  // or stop doing so if offset is -1.  The records must already be
+  // in that order.
+  const Status setCluster(const int offset,
+                          const int length,
+                          const Datatype type);
 };
 
 
@@ -91,15 +125,28 @@ public:
     // delete current record 
     const Status deleteRecord();
 
+    // delete all records that satisfy the scan predicate, rewriting
+    // each page once; returns the number deleted in delCnt
+    const Status deleteMatches(int& delCnt);
+
     // marks current page of scan dirty
     const Status markDirty();
 
+    // skip the records whose attribute at offset bloom rules out, on
+    // top of the scan predicate; NULL turns the test off. For scans
+    // that read, not for deleteMatches().
+    void setBloom(const BloomFilter* bloom, const int offset);
+
 private:
     int   offset;            // byte offset of filter attribute
     int   length;            // length of filter attribute
     Datatype type;           // datatype of filter attribute
     const char* filter;      // comparison value of filter
     Operator op;             // comparison operator of filter
+    bool  stopEarly;         // file is ordered on the filter attribute
+                             // and op has an upper bound
+    const BloomFilter* bloom; // filter on the attribute at bloomOffset
+    int   bloomOffset;
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -109,9 +156,22 @@ private:
     RID   markedRec;         // rid of last record returned
 
     const bool matchRec(const Record & rec) const;
+
+    // true if the record, and therefore every later record of an
+    // ordered file, sorts after the range the scan is looking for
+    const bool pastRange(const Record & rec) const;
 };
 
 
+// A record that got a new RID when a page of a clustered file was
+// rebuilt to make room for an insert.
+
+typedef struct {
+    RID from;		// RID before the insert
+    RID to;		// RID after the insert
+} RIDMOVE;
+
+
 class InsertFileScan : public HeapFile
 {
 public:
@@ -123,6 +183,57 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // insert recCnt records, returning their RIDs in outRids[] if it
+    // is not NULL; new pages are allocated and written in groups and
+    // slack bytes are left free on each of them
+    const Status insertRecords(const Record recs[],
+                               const int recCnt,
+                               RID outRids[],
+                               const int slack = 0);
+
+    // append recCnt packed fixed-length tuples, building whole pages
+    // outside the buffer pool and writing them in runs; the RIDs are
+    // returned in outRids[] if it is not NULL
+    const Status bulkInsert(const char* tuples,
+                            const int recLen,
+                            const int recCnt,
+                            RID outRids[] = NULL);
+
+    // append to moves the records that later inserts into a clustered
+    // file move to a new RID; NULL stops the tracking
+    void trackMoves(vector<RIDMOVE>* moves);
+
+private:
+    vector<RIDMOVE>* moves;	// where moved records are reported
+
+    // insert a record at its place in a clustered file
+    const Status insertOrdered(const Record & rec, RID& outRid);
+};
+
+
+// Buffers records on their way into an InsertFileScan so that they
+// are inserted with insertRecords() a batch at a time.  The caller
+// must call flush() once the last record has been added.
+
+class InsertBatch
+{
+public:
+    InsertBatch(InsertFileScan* file, const int slack = 0);
+    ~InsertBatch();
+
+    // copy record into the batch, flushing the batch if it is full
+    const Status insert(const Record & rec);
+
+    // insert all buffered records into the file
+    const Status flush();
+
+private:
+    InsertFileScan* file;       // file the records are inserted into
+    int		slack;          // bytes to leave free on new pages
+    char*	data;           // copies of the buffered records
+    int		used;           // bytes of data[] in use
+    vector<Record> recs;        // descriptors of the buffered records
 };
 
 #endif
@@ -0,0 +1,46 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include "catalog.h"
+
+//
+// Prototypes for index layer functions. An attribute with the
+// BTREEINDEX (HASHINDEX, BITMAPINDEX) flag set in the attribute
+// catalog has a B+-tree (hash, bitmap) index kept in the file named
+// by IX_IndexName(). The
+// entries of a relation are passed as packed tuples of the given
+// width with their RIDs.
+//
+
+const string IX_IndexName(const string & relation,
+                          const string & attrName,
+                          const int kind = BTREEINDEX);
+
+const Status IX_Create(const string & relation,
+                       const string & attrName,
+                       const int kind = BTREEINDEX,
+                       const int nbuckets = 1);
+
+const Status IX_Drop(const string & relation,
+                     const string & attrName);
+
+const Status IX_Rebuild(const string & relation);
+
+const bool IX_Indexed(const int attrCnt,
+                      const AttrDesc attrs[]);
+
+const Status IX_InsertEntries(const int attrCnt,
+                              const AttrDesc attrs[],
+                              const char *tuples,
+                              const int width,
+                              const int count,
+                              const RID rids[]);
+
+const Status IX_DeleteEntries(const int attrCnt,
+                              const AttrDesc attrs[],
+                              const char *tuples,
+                              const int width,
+                              const int count,
+                              const RID rids[]);
+
+#endif
@@ -1,40 +1,38 @@
+#include <vector>
+
+// Hash table on the join attribute of a set of outer tuples, mapping
+// the join value of each tuple to its RID. It is a flat open addressing
+// table: the hash tag, the RID and a copy of the key of each entry are
+// kept in three arrays in a single allocation, so that a probe reads
+// consecutive tags and compares keys only when the tags agree. Tuples
+// with equal keys take separate slots.
 
 class joinHashTbl
 {
 private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
-    {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
-    };
-
-    struct HTentry
-    {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
-    };
-
     AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    int 	keyLen;         // bytes of a key
+    int 	HTSIZE;         // number of slots, a power of two
+    int 	entryCnt;       // number of slots in use
+    char*	arena;          // storage of the three arrays below
+    unsigned int* tags;     // hash of the key of each slot, 0 if empty
+    RID*	rids;           // RID of each slot
+    char*	keys;           // key of each slot, keyLen bytes each
+
+    unsigned int hash(const char* attrPtr) const; // never 0
+    void allocate(const int size);
+    void grow();            // double the number of slots
 
 public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
+    joinHashTbl(const int size, const AttrDesc attr);  // size: expected
+                                                        // number of tuples
     ~joinHashTbl();
 
      // insert a new (JoinAttrValue, RID) pair into hash table
      Status insert(const RID newRid,  const char* tuple);
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
+     // get RIDs of records whose join attribute value matches
+     // innerJoinAttrValue; outRids is emptied first and keeps its
+     // storage from one probe to the next
+     Status lookup(const char* innerJoinAttrPtr, vector<RID> & outRids) const;
 };
-
@@ -59,6 +59,10 @@ public:
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
+    // delete the cnt records with the specified rids, compacting
+    // the page only once
+    const Status deleteRecords(const RID rids[], const int cnt);
+
     // returns RID of first record on page
     // returns  NORECORDS if page contains no records.  Otherwise, returns OK
     const Status firstRecord(RID& firstRid) const;
@@ -49,6 +49,8 @@ typedef enum {
     N_QUERY,
     N_INSERT,
     N_DELETE,
+    N_TRUNCATE,
+    N_ANALYZE,
     N_CREATE,
     N_DESTROY,
     N_BUILD,
@@ -59,13 +61,19 @@ typedef enum {
     N_HELP,
     N_SELECT,
     N_JOIN,
+    N_CONDITION,
     N_PRIMATTR,
     N_QUALATTR,
     N_ATTRVAL,
     N_ATTRTYPE,
     N_VALUE,
     N_LIST,
-    N_ALIAS
+    N_ALIAS,
+    N_PREPARE,
+    N_EXECUTE,
+    N_PARAM,
+    N_AGGREGATE,
+    N_SORTKEY
 } NODEKIND;
 
 
@@ -82,6 +90,11 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    struct node *grouplist;     // NULL if not grouped
+	    struct node *sortlist;      // NULL if not ordered
+	    int vectorized;             // 1 to run on batches of columns
+	    int selfjoin;               // 1 if the from list names a
+	                                // relation twice
 	} QUERY;
 
 	// insert node */
@@ -96,11 +109,22 @@ typedef struct node {
 	    struct node *qual;
 	} DELETE;
 
+	// truncate node */
+	struct {
+	    char *relname;
+	} TRUNCATE;
+
+	// analyze node */
+	struct {
+	    char *relname;
+	} ANALYZE;
+
 	// create node */
 	struct {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *primattr;
+	    char *clusterattr;          // NULL if not clustered
 	} CREATE;
 
 	// destroy node */
@@ -112,6 +136,7 @@ typedef struct node {
 	struct {
 	    char *relname;
 	    char *attrname;
+	    int kind;                   // 0, RW_HASH or RW_BITMAP
 	    int nbuckets;
 	} BUILD;
 
@@ -125,6 +150,7 @@ typedef struct node {
 	struct {
 	    char *relname;
 	    char *filename;
+	    int csv;                    // 1 if file is CSV text
 	} LOAD;
 
 	// pprint node */
@@ -151,6 +177,13 @@ typedef struct node {
 	    struct node *joinattr2;
 	} JOIN;
 
+	// boolean combination of selections */
+	struct {
+	    int op;                     // RW_AND, RW_OR or RW_NOT
+	    struct node *left;
+	    struct node *right;         // NULL for RW_NOT
+	} CONDITION;
+
 	// qualified attribute node */
 	struct {
 	    char *relname;
@@ -203,6 +236,35 @@ typedef struct node {
 	  char *relname;
 	  char *alias;
 	} ALIAS;
+
+	// prepare node */
+	struct {
+	    char *name;
+	    struct node *stmt;          // select, insert or delete
+	} PREPARE;
+
+	// execute node */
+	struct {
+	    char *name;
+	    struct node *args;          // list of values, NULL if none
+	} EXECUTE;
+
+	// parameter (`?') of a prepared statement */
+	struct {
+	    int num;                    // position among the parameters
+	} PARAM;
+
+	// aggregate function of an attribute */
+	struct {
+	    char *func;                 // name of the function
+	    struct node *attr;          // no attrname for count(*)
+	} AGGREGATE;
+
+	// sort key */
+	struct {
+	    struct node *attr;          // attribute or aggregate
+	    int desc;                   // 1 for descending order
+	} SORTKEY;
     } u;
 } NODE;
 
@@ -212,19 +274,26 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *grouplist,
+		 NODE *sortlist, int vectorized, int selfjoin);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
-NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
+NODE *create_node(char *relname, NODE *attrlist, NODE *primattr,
+		  char *clusterattr);
+NODE *truncate_node(char *relname);
+NODE *analyze_node(char *relname);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int kind, int nbuckets);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
-NODE *load_node(char *relname, char *filename);
+NODE *load_node(char *relname, char *filename, int csv);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *prepare_node(char *name, NODE *stmt);
+NODE *execute_node(char *name, NODE *args);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
+NODE *condition_node(int op, NODE *left, NODE *right);
 NODE *qualattr_node(char *relname, char *attrname);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
@@ -233,10 +302,16 @@ NODE *attrtype_node(char *attrname, int type /*char *type*/);
 NODE *int_node(int ival);
 NODE *float_node(float rval);
 NODE *string_node(char *s);
+NODE *param_node(void);
+NODE *aggregate_node(char *func, NODE *attr);
+NODE *sortkey_node(NODE *attr, int desc);
 NODE *list_node(NODE *n);
 NODE *prepend(NODE *n, NODE *list);
 NODE *merge_attr_value_list(NODE *attr_list, NODE *value_list);
 NODE *alias_node(char *relname, char *alias);
+int repeated_relation(NODE *alias);
 NODE *replace_alias_in_qualattr_list(NODE *alias, NODE *qualattr_list);
 NODE *replace_alias_in_condition(NODE *alias, NODE *where);
+NODE *copy_tree(NODE *n);
+void free_tree(NODE *n);
 #endif
@@ -51,6 +51,22 @@ static NODE *parse_tree;                // root of parse tree
 		RW_OR
 		RW_NOT
 		RW_VALUES	
+		RW_CSV
+		RW_TRUNCATE
+		RW_CLUSTER
+		RW_BY
+		RW_INDEX
+		RW_ON
+		RW_HASH
+		RW_BITMAP
+		RW_PREPARE
+		RW_EXECUTE
+		RW_ANALYZE
+		RW_ORDER
+		RW_GROUP
+		RW_ASC
+		RW_DESC
+		RW_VECTORIZED
 		INT_TYPE
 		REAL_TYPE
 		CHAR_TYPE	
@@ -73,15 +89,19 @@ static NODE *parse_tree;                // root of parse tree
 		T_SHELL_CMD
 
 %type	<ival>	op
+		opt_vectorized
 
 %type	<sval>	opt_into_relname
 		opt_relname
+		opt_cluster_attr
 		string
 
 %type	<n>	command
 		query
 		insert
 		delete
+		truncate
+		analyze
 		create
 		destroy
 		build
@@ -93,13 +113,26 @@ static NODE *parse_tree;                // root of parse tree
 		print
 		help
 		quit
+		prepare
+		execute
+		statement
 		opt_primary_attr
 		opt_where
 		qual
+		condition
+		conjunction
+		factor
 		selection
 		join
 		non_mt_qualattr_list
+		qualattr_list
 		qualattr
+		outattr
+		aggregate
+		opt_group_by
+		opt_order_by
+		sortkey_list
+		sortkey
 /*
 		non_mt_attrval_list
 		attrval
@@ -111,6 +144,7 @@ static NODE *parse_tree;                // root of parse tree
 		attrib_list
 		value_list
 		val
+		arg_list
 		table_list
 		table
 %%
@@ -145,6 +179,8 @@ command
 	: query
 	| insert
 	| delete
+	| truncate
+	| analyze
 	| create
 	| destroy
 	| build
@@ -156,6 +192,8 @@ command
 	| print
 	| help
 	| quit
+	| prepare
+	| execute
 	| nothing
 	{
 		$$ = NULL;
@@ -163,26 +201,43 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT opt_vectorized non_mt_qualattr_list opt_into_relname RW_FROM
+	  table_list opt_where opt_group_by opt_order_by
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
-		NODE *where;
-		NODE *qualattr_list = replace_alias_in_qualattr_list($5, $2);
+		NODE *where, *group, *order;
+		NODE *qualattr_list = replace_alias_in_qualattr_list($6, $3);
 		if (qualattr_list == NULL) { // something wrong in qualattr_list
 		  $$ = NULL;
 		}
 		else {
-		  where = replace_alias_in_condition($5, $6);
-		  if ((where == NULL) && ($6 != NULL)) {
-		     $$ = NULL; //something wrong in where condition
+		  where = replace_alias_in_condition($6, $7);
+		  group = replace_alias_in_qualattr_list($6, $8);
+		  order = replace_alias_in_qualattr_list($6, $9);
+		  if (((where == NULL) && ($7 != NULL)) ||
+		      ((group == NULL) && ($8 != NULL)) ||
+		      ((order == NULL) && ($9 != NULL))) {
+		     $$ = NULL; //something wrong in where, group by or order by
 		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($4, qualattr_list, where, group, order, $2,
+				    repeated_relation($6));
 		  }
 		}
 	}
 	;
 
+opt_vectorized
+	: RW_VECTORIZED
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
 table_list
 	: '(' table_list ')'
 	{
@@ -247,6 +302,10 @@ val
 	{
 		$$ = $1;
 	}
+	| '?'
+	{
+		$$ = param_node();
+	}
 
 delete
 	: RW_DELETE RW_FROM string opt_where
@@ -257,8 +316,31 @@ delete
 
 create
 	: RW_CREATE RW_TABLE string '(' non_mt_attrtype_list ')' opt_primary_attr
+	  opt_cluster_attr
+	{
+		$$ = create_node($3, $5, $7, $8);
+	}
+	;
+
+truncate
+	: RW_TRUNCATE RW_TABLE string
+	{
+		$$ = truncate_node($3);
+	}
+	| RW_TRUNCATE string
+	{
+		$$ = truncate_node($2);
+	}
+	;
+
+analyze
+	: RW_ANALYZE RW_TABLE string
+	{
+		$$ = analyze_node($3);
+	}
+	| RW_ANALYZE string
 	{
-		$$ = create_node($3, $5, $7);
+		$$ = analyze_node($2);
 	}
 	;
 
@@ -272,7 +354,23 @@ destroy
 build
 	: RW_BUILD string '(' string ')'
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
+	{
+		$$ = build_node($2, $4, RW_HASH, $8);
+	}
+	| RW_CREATE RW_INDEX RW_ON string '(' string ')'
+	{
+		$$ = build_node($4, $6, 0, 0);
+	}
+	| RW_CREATE RW_HASH RW_INDEX RW_ON string '(' string ')'
+	{
+		$$ = build_node($5, $7, RW_HASH, 1);
+	}
+	| RW_CREATE RW_BITMAP RW_INDEX RW_ON string '(' string ')'
+	{
+		$$ = build_node($5, $7, RW_BITMAP, 0);
 	}
 	;
 
@@ -299,7 +397,11 @@ drop
 load
 	: RW_LOAD RW_TABLE string RW_FROM '(' T_QSTRING ')'
 	{
-		$$ = load_node($3, $6);
+		$$ = load_node($3, $6, 0);
+	}
+	| RW_LOAD RW_TABLE string RW_FROM RW_CSV '(' T_QSTRING ')'
+	{
+		$$ = load_node($3, $7, 1);
 	}
 	;
 print
@@ -323,6 +425,41 @@ quit
 	}
 	;
 
+prepare
+	: RW_PREPARE string RW_AS statement
+	{
+		$$ = $4 == NULL ? NULL : prepare_node($2, $4);
+	}
+	;
+
+statement
+	: query
+	| insert
+	| delete
+	;
+
+execute
+	: RW_EXECUTE string '(' arg_list ')'
+	{
+		$$ = execute_node($2, $4);
+	}
+	| RW_EXECUTE string
+	{
+		$$ = execute_node($2, NULL);
+	}
+	;
+
+arg_list
+	: value ',' arg_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| value
+	{
+		$$ = list_node($1);
+	}
+	;
+
 opt_primary_attr
 	: RW_PRIMARY string RW_NUMBUCKETS T_EQ T_INT
 	{
@@ -334,6 +471,17 @@ opt_primary_attr
 	}
 	;
 
+opt_cluster_attr
+	: RW_CLUSTER RW_BY string
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
 opt_into_relname
 	: RW_INTO string
 	{
@@ -368,7 +516,35 @@ opt_where
 	;
 
 qual
-	: selection
+	: condition
+	;
+
+condition
+	: condition RW_OR conjunction
+	{
+		$$ = condition_node(RW_OR, $1, $3);
+	}
+	| conjunction
+	;
+
+conjunction
+	: conjunction RW_AND factor
+	{
+		$$ = condition_node(RW_AND, $1, $3);
+	}
+	| factor
+	;
+
+factor
+	: RW_NOT factor
+	{
+		$$ = condition_node(RW_NOT, $2, NULL);
+	}
+	| '(' condition ')'
+	{
+		$$ = $2;
+	}
+	| selection
 	| join
 	;
 
@@ -377,6 +553,10 @@ selection
 	{
 		$$ = select_node($1, $2, $3);
 	}
+	| qualattr op '?'
+	{
+		$$ = select_node($1, $2, param_node());
+	}
 	;
 
 join
@@ -391,7 +571,45 @@ non_mt_qualattr_list
 	{
 		$$ = $2;
 	}
-	| qualattr ',' non_mt_qualattr_list
+	| outattr ',' non_mt_qualattr_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| outattr
+	{
+		$$ = list_node($1);
+	}
+	;
+
+outattr
+	: qualattr
+	| aggregate
+	;
+
+aggregate
+	: string '(' qualattr ')'
+	{
+		$$ = aggregate_node($1, $3);
+	}
+	| string '(' '*' ')'
+	{
+		$$ = aggregate_node($1, qualattr_node(NULL, NULL));
+	}
+	;
+
+opt_group_by
+	: RW_GROUP RW_BY qualattr_list
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+qualattr_list
+	: qualattr ',' qualattr_list
 	{
 		$$ = prepend($1, $3);
 	}
@@ -401,6 +619,43 @@ non_mt_qualattr_list
 	}
 	;
 
+opt_order_by
+	: RW_ORDER RW_BY sortkey_list
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+sortkey_list
+	: sortkey ',' sortkey_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| sortkey
+	{
+		$$ = list_node($1);
+	}
+	;
+
+sortkey
+	: outattr
+	{
+		$$ = sortkey_node($1, 0);
+	}
+	| outattr RW_ASC
+	{
+		$$ = sortkey_node($1, 0);
+	}
+	| outattr RW_DESC
+	{
+		$$ = sortkey_node($1, 1);
+	}
+	;
+
 qualattr
 	: string '.' string
 	{
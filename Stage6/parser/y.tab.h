@@ -63,22 +63,38 @@
      RW_OR = 279,
      RW_NOT = 280,
      RW_VALUES = 281,
-     INT_TYPE = 282,
-     REAL_TYPE = 283,
-     CHAR_TYPE = 284,
-     T_EQ = 285,
-     T_LT = 286,
-     T_LE = 287,
-     T_GT = 288,
-     T_GE = 289,
-     T_NE = 290,
-     T_EOF = 291,
-     NOTOKEN = 292,
-     T_INT = 293,
-     T_REAL = 294,
-     T_STRING = 295,
-     T_QSTRING = 296,
-     T_SHELL_CMD = 297
+     RW_CSV = 282,
+     RW_TRUNCATE = 283,
+     RW_CLUSTER = 284,
+     RW_BY = 285,
+     RW_INDEX = 286,
+     RW_ON = 287,
+     RW_HASH = 288,
+     RW_BITMAP = 289,
+     RW_PREPARE = 290,
+     RW_EXECUTE = 291,
+     RW_ANALYZE = 292,
+     RW_ORDER = 293,
+     RW_GROUP = 294,
+     RW_ASC = 295,
+     RW_DESC = 296,
+     RW_VECTORIZED = 297,
+     INT_TYPE = 298,
+     REAL_TYPE = 299,
+     CHAR_TYPE = 300,
+     T_EQ = 301,
+     T_LT = 302,
+     T_LE = 303,
+     T_GT = 304,
+     T_GE = 305,
+     T_NE = 306,
+     T_EOF = 307,
+     NOTOKEN = 308,
+     T_INT = 309,
+     T_REAL = 310,
+     T_STRING = 311,
+     T_QSTRING = 312,
+     T_SHELL_CMD = 313
    };
 #endif
 /* Tokens.  */
@@ -106,22 +122,38 @@
 #define RW_OR 279
 #define RW_NOT 280
 #define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_CSV 282
+#define RW_TRUNCATE 283
+#define RW_CLUSTER 284
+#define RW_BY 285
+#define RW_INDEX 286
+#define RW_ON 287
+#define RW_HASH 288
+#define RW_BITMAP 289
+#define RW_PREPARE 290
+#define RW_EXECUTE 291
+#define RW_ANALYZE 292
+#define RW_ORDER 293
+#define RW_GROUP 294
+#define RW_ASC 295
+#define RW_DESC 296
+#define RW_VECTORIZED 297
+#define INT_TYPE 298
+#define REAL_TYPE 299
+#define CHAR_TYPE 300
+#define T_EQ 301
+#define T_LT 302
+#define T_LE 303
+#define T_GT 304
+#define T_GE 305
+#define T_NE 306
+#define T_EOF 307
+#define NOTOKEN 308
+#define T_INT 309
+#define T_REAL 310
+#define T_STRING 311
+#define T_QSTRING 312
+#define T_SHELL_CMD 313
 
 
 
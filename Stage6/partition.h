@@ -17,13 +17,23 @@ class Partition {
 				 const int P),  
 	                               // hash function to use in partitioning
 	    string* &partName,           // names of partitioned heap files
-	    Status &status);            // create partitions of file
+	    Status &status,             // create partitions of file
+	    const Status (*keep)(const Record & rec,
+				 void *arg) = NULL,
+	                               // takes the records of partition 0
+	    void *arg = NULL);           // passed to keep
   ~Partition();                         // destroy partitions
 
+  const int getBytes() const            // bytes written to partitions
+  {
+    return bytes;
+  }
+
  private:
 
   int P;                                // number of partitions
   string *partName;                      // partition names
+  int bytes;                            // bytes written to partitions
 };
 
 #endif
@@ -1,9 +1,104 @@
 #ifndef QUERY_H
 #define QUERY_H
 
-#include "heapfile.h"
+#include "catalog.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+// IndexNLJoin is never given on the command line; CostJoin has
+// QU_PlanJoin pick the method of each join.
+enum JoinType {NLJoin, SMJoin, HashJoin, BlockNLJoin, IndexNLJoin, CostJoin};
+
+const int MAXJOINTHREADS = 32;  // threads a join may run on
+
+//
+// A selection condition: a comparison (attr op value, with the value
+// as a string in attr.attrValue), or the AND, OR or NOT of conditions.
+//
+
+enum CondKind {CONDCMP, CONDAND, CONDOR, CONDNOT};
+
+struct Condition {
+  CondKind kind;
+  attrInfo attr;                // CONDCMP: attribute and value
+  Operator op;                  // CONDCMP: comparison operator
+  Condition *left;              // operands; right is NULL for CONDNOT
+  Condition *right;
+};
+
+//
+// A selection condition with its attributes looked up and its values
+// converted; the nodes of a condition are kept in a vector, with the
+// root first.
+//
+
+struct CondNode {
+  CondKind kind;
+  AttrDesc attr;                // CONDCMP: attribute
+  Operator op;                  // CONDCMP: comparison operator
+  vector<char> value;           // CONDCMP: converted value
+  int left, right;              // operands, -1 if none
+};
+
+//
+// A join predicate of a multi-way join: (attr1 op attr2).
+//
+
+struct JoinPred {
+  attrInfo attr1;
+  Operator op;
+  attrInfo attr2;
+};
+
+//
+// A result attribute, grouping attribute or sort key of a pipelined
+// query: an attribute, or an aggregate of an attribute.
+//
+
+enum AggFunc {AGGNONE, AGGCOUNT, AGGSUM, AGGAVG, AGGMIN, AGGMAX};
+
+struct QueryAttr {
+  attrInfo attr;
+  AggFunc func;                 // AGGNONE for the attribute itself
+  bool desc;                    // sort key: descending order
+};
+
+//
+// A plan of a simple select, insert or delete: its attributes resolved
+// against the catalogs, the layout of the records it builds and, for a
+// select, how the relation is read. Statements that differ only in
+// their values share a plan; the values are passed when it is run.
+// A plan goes stale when the catalog entries of its relation change.
+//
+
+enum PlanKind {PLANSELECT, PLANINSERT, PLANDELETE};
+enum AccessMethod {SCANACCESS, INDEXACCESS, BITMAPACCESS};
+
+struct Plan {
+  PlanKind kind;
+  string relation;              // relation read or updated
+  int version;                  // its catalog version when planned
+  vector<AttrDesc> attrs;       // all attributes of the relation
+  int reclen;                   // length of its records
+  vector<AttrDesc> proj;        // PLANSELECT: projected attributes
+  int projlen;                  // PLANSELECT: length of result records
+  vector<int> slots;            // PLANINSERT: value of each attribute
+  bool hasSel;                  // PLANSELECT: false if no selection
+  AttrDesc sel;                 // selection attribute
+  Operator op;                  // selection operator
+  AccessMethod method;          // PLANSELECT: how the relation is read
+};
+
+//
+// A plan of a join: the method picked by QU_PlanJoin and whether the
+// two relations change places, the relation of attr2 being read as
+// the outer one. The cost is an estimate in page reads, a tuple or a
+// comparison counting as a fraction of a page.
+//
+
+struct JoinPlan {
+  JoinType method;
+  bool swap;                    // the relation of attr2 is the outer one
+  double cost;                  // estimated cost of the plan
+};
 
 //
 // Prototypes for query layer functions
@@ -17,6 +112,11 @@ const Status QU_Select(const string & result,
 		       const Operator op, 
 		       const char *attrValue);
 
+const Status QU_SelectCond(const string & result,
+			   const int projCnt,
+			   const attrInfo projNames[],
+			   const Condition *cond);
+
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
 		     const attrInfo projNames[],
@@ -24,6 +124,27 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+const Status QU_MultiJoin(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const int predCnt,
+			  const JoinPred preds[],
+			  const int condCnt,
+			  const Condition * const conds[]);
+
+const Status QU_Pipeline(const string & result,
+			 const int projCnt,
+			 const QueryAttr projNames[],
+			 const int predCnt,
+			 const JoinPred preds[],
+			 const int condCnt,
+			 const Condition * const conds[],
+			 const int groupCnt,
+			 const QueryAttr groupNames[],
+			 const int sortCnt,
+			 const QueryAttr sortKeys[],
+			 const bool vectorized = false);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
@@ -34,4 +155,71 @@ const Status QU_Delete(const string & relation,
 		       const Datatype type, 
 		       const char *attrValue);
 
+const Status QU_Truncate(const string & relation);
+
+const Status QU_PlanSelect(const int projCnt,
+			   const attrInfo projNames[],
+			   const attrInfo *attr,
+			   const Operator op,
+			   Plan & plan);
+
+const Status QU_RunSelect(const string & result,
+			  const Plan & plan,
+			  const char *attrValue);
+
+const Status QU_PlanInsert(const string & relation,
+			   const int attrCnt,
+			   const attrInfo attrList[],
+			   Plan & plan);
+
+const Status QU_RunInsert(const Plan & plan,
+			  const char *values[]);
+
+const Status QU_PlanDelete(const string & relation,
+			   const string & attrName,
+			   const Operator op,
+			   Plan & plan);
+
+const Status QU_RunDelete(const Plan & plan,
+			  const Datatype type,
+			  const char *attrValue);
+
+const bool QU_PlanValid(const Plan & plan);
+
+const Status QU_PlanJoin(const attrInfo *attr1,
+			 const Operator op,
+			 const attrInfo *attr2,
+			 JoinPlan & plan);
+
+// look up the attributes of a condition on relation relName and append
+// its nodes to cond
+const Status resolveCond(const Condition *c,
+			 const string & relName,
+			 vector<CondNode> & cond);
+
+// does a comparison whose result is c satisfy op?
+bool opMatches(const int c, const Operator op);
+
+// the operator with the operands exchanged: (a op b) iff (b swapOp(op) a)
+Operator swapOp(const Operator op);
+
+// evaluate condition node i on a record
+bool evalCond(const vector<CondNode> & cond, const int i,
+	      const char *rec);
+
+// estimate the fraction of the records satisfying condition node i
+double condSelectivity(const vector<CondNode> & cond, const int i);
+
+// how to read the records of a relation satisfying a condition on it
+AccessMethod QU_CondAccess(const vector<CondNode> & cond);
+
+// collect, in file order, the RIDs of the records of a relation that
+// may satisfy a condition, through the indexes QU_CondAccess picked;
+// exact tells whether they all satisfy it
+const Status QU_CondRids(const string & relation,
+			 const vector<CondNode> & cond,
+			 const AccessMethod method,
+			 vector<RID> & rids,
+			 bool & exact);
+
 #endif
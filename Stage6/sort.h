@@ -2,6 +2,7 @@
 #define SORT_H
 
 #include "heapfile.h"
+#include "bloom.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
@@ -24,7 +25,12 @@ class SortedFile {
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     bool inPlace = true,       // read a file that is in order
+                                        // directly instead of copying it
+	     BloomFilter* keys = NULL,  // gets the key of every record
+	     const BloomFilter* filter = NULL); // leaves out the records
+                                        // whose key it rules out
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
@@ -33,6 +39,8 @@ class SortedFile {
 
  private:
   Status sortFile();                    // split source file into sub-runs
+  Status checkOrder(bool & ordered);    // is source file in sort order?
+  Status addKeys();                     // add all keys to keys
   Status generateRun(int numItems);     // generate one sub-run of file
   Status startScans();                  // start a scan on each sorted run
 
@@ -57,7 +65,23 @@ class SortedFile {
 
   SORTREC* buffer;                      // in-memory sort buffer
   int maxItems;                         // max. # of items/tuples in buffer
+  bool inPlace;                         // may read source file directly
+  BloomFilter* keys;                    // filter the keys are added to
+  const BloomFilter* filter;            // filter the records must pass
   int numItems;                         // current # of items in buffer
 };
 
+
+// Number of records sorted in memory at a time when a file is
+// rebuilt in clustered order.
+
+const int CLUSTERSORTITEMS = 50000;
+
+// Rebuild a heap file ordered on the given attribute and keep it
+// ordered from then on.
+
+const Status clusterHeapFile(const string & fileName,
+                             const int offset, const int length,
+                             const Datatype type);
+
 #endif
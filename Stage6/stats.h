@@ -0,0 +1,123 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <unordered_map>
+#include <vector>
+#include "catalog.h"
+
+
+// Statistics on the values of the attributes of a relation, gathered
+// by "analyze rel" and kept in the statistics catalog. The distinct
+// values are counted with a HyperLogLog sketch of all the records; the
+// histogram and the most common values are taken from a sample of at
+// most STATSAMPLE records. Values are kept as their first STATVALLEN
+// bytes, which is all of an integer or a float and a prefix of a
+// string.
+
+const int STATBUCKETS = 16;             // buckets of a histogram
+const int STATMCVS = 8;                 // most common values kept
+const int STATVALLEN = 8;               // bytes kept of a value
+const int STATHLLBITS = 8;              // hash bits choosing a register
+const int STATHLLREGS = 1 << STATHLLBITS;
+const int STATSAMPLE = 10000;           // records sampled
+
+// The statistics of a relation are gathered again when its record
+// count has drifted from the count they describe by more than
+// STATDRIFT percent, and by at least STATMINDRIFT records.
+
+const int STATDRIFT = 20;
+const int STATMINDRIFT = 20;
+
+
+// schema of statistics catalog: one tuple per attribute
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   record count : integer(4)
+//   sample size : integer(4)
+//   distinct values : integer(4)
+//   histogram buckets : integer(4)
+//   common values : integer(4)
+//   sketch : char(...)  (the rest of StatDesc, binary)
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  int recCnt;                           // records when analyzed
+  int sampleCnt;                        // records sampled
+  int distinct;                         // estimated distinct values
+  int bucketCnt;                        // buckets of the histogram, 0
+                                        // if the relation was empty
+  int mcvCnt;                           // common values kept
+  char minVal[STATVALLEN];              // smallest value
+  char maxVal[STATVALLEN];              // largest value
+  char bounds[STATBUCKETS + 1][STATVALLEN];  // bucketCnt + 1 bounds of
+                                        // equi-depth buckets
+  char mcv[STATMCVS][STATVALLEN];       // most common values
+  float mcvFreq[STATMCVS];              // fraction of records of each
+  unsigned char hll[STATHLLREGS];       // HyperLogLog registers
+} StatDesc;
+
+
+typedef struct {
+  StatDesc desc;
+  RID rid;
+} StatEntry;
+
+
+class StatCatalog {
+ public:
+  // open statistics catalog, creating it for databases made without
+  // one
+  StatCatalog(Status &status);
+
+  // get the statistics of an attribute, NOSTATS if there are none
+  const Status getInfo(const string & relation,
+                       const string & attrName,
+                       StatDesc &record) const;
+
+  // add the statistics of an attribute, replacing any there are
+  const Status setInfo(StatDesc & record);
+
+  // record count the statistics of a relation describe, -1 if the
+  // relation was never analyzed
+  const int getRecCnt(const string & relation) const;
+
+  // delete the statistics of a relation
+  const Status dropRelation(const string & relation);
+
+  ~StatCatalog();
+
+ private:
+  unordered_map<string, vector<StatEntry> > cache;
+                                        // tuples of each relation
+};
+
+
+extern StatCatalog *statCat;
+
+
+//
+// Prototypes for statistics functions
+//
+
+// gather the statistics of all attributes of a relation
+const Status ST_Analyze(const string & relation);
+
+// gather them again if the relation was analyzed and has changed
+// enough since
+const Status ST_Refresh(const string & relation);
+
+// fraction of the records whose attribute satisfies (attr op value),
+// value being in the format of the attribute
+const Status ST_Selectivity(const AttrDesc & attr,
+                            const Operator op,
+                            const char *value,
+                            double & sel);
+
+// fraction of the pairs of records that satisfy (attr1 op attr2)
+const Status ST_JoinSelectivity(const AttrDesc & attr1,
+                                const Operator op,
+                                const AttrDesc & attr2,
+                                double & sel);
+
+#endif
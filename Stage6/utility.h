@@ -25,6 +25,9 @@ using namespace std;
 const Status UT_Load(const string & relation, 
 		     const string & fileName);
 
+const Status UT_LoadCSV(const string & relation, 
+			const string & fileName);
+
 const Status UT_Print(string relation);
 
 void   UT_Quit(void);
@@ -0,0 +1,284 @@
+#ifndef VEXEC_H
+#define VEXEC_H
+
+#include <vector>
+#include "exec.h"
+
+using namespace std;
+
+
+// Vectorized query execution. The iterators of a vectorized plan hand
+// each other batches of up to VECSIZE rows kept as columns: the values
+// of an attribute for all the rows of a batch lie next to each other,
+// so an INTEGER or FLOAT column is an array of int or float and a
+// STRING column holds attrLen bytes per row. A batch may come with a
+// selection vector, the rows of the batch that are in the result, in
+// increasing order; a filter only narrows the selection instead of
+// moving any values. The work on the columns is done by loops over a
+// column of one type, one for each operation and type.
+//
+// A vectorized plan is made from a plan of row iterators by
+// Iterator::vectorize(), which leaves out the columns that no operator
+// above uses. As with the row iterators, a batch returned by next()
+// stays valid until the following call of next() or close(), and the
+// inner input of a join, the input of a sort and that of an
+// aggregation are read into memory by open().
+
+#define VECSIZE 1024                    // rows in a batch
+
+
+struct Batch {
+  int count;                            // rows in the columns
+  vector<const char *> cols;            // a column per attribute
+  const int *sel;                       // rows selected, NULL if all are
+  int selCount;                         // rows selected
+};
+
+
+class VecIter {
+ public:
+  virtual ~VecIter() {}
+
+  virtual const Status open() = 0;
+  virtual const Status next(Batch & batch) = 0;   // FILEEOF at the end
+  virtual const Status close() = 0;
+
+  // the attributes of the columns; the offsets are not used
+  const vector<AttrDesc> & getSchema() const { return schema; }
+
+ protected:
+  vector<AttrDesc> schema;
+};
+
+
+// A comparison of two columns of a batch, (col1 op col2).
+
+struct VecPred {
+  int col1;
+  Operator op;
+  int col2;
+};
+
+
+// The attributes attrs of the records of a relation, taken out of the
+// records into columns.
+
+class VecScan : public VecIter {
+ public:
+  VecScan(const string & relation, const vector<AttrDesc> & attrs);
+  ~VecScan();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  string relation;
+  HeapFileScan *scan;
+  bool done;
+  vector< vector<char> > cols;
+};
+
+
+// The attributes attrs of the records of input, a plan of row
+// iterators, taken out of the records into columns. Owns input.
+
+class VecRecords : public VecIter {
+ public:
+  VecRecords(Iterator *input, const vector<AttrDesc> & attrs);
+  ~VecRecords();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  Iterator *input;
+  bool done;
+  vector< vector<char> > cols;
+};
+
+
+// The rows of input satisfying all of conds, whose comparisons are
+// with the columns condCols gives for their nodes, and all of checks.
+
+class VecFilter : public VecIter {
+ public:
+  VecFilter(VecIter *input, const vector< vector<CondNode> > & conds,
+            const vector< vector<int> > & condCols,
+            const vector<VecPred> & checks);
+  ~VecFilter();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  VecIter *input;
+  vector< vector<CondNode> > conds;
+  vector< vector<int> > condCols;
+  vector<VecPred> checks;
+  vector< vector< vector<int> > > scratch;  // a selection per node
+  vector<int> sel[2];
+
+  int select(const Batch & batch, const int c, const int i,
+             const int *in, const int n, int *out);
+};
+
+
+// The columns cols of the batches of input, in that order.
+
+class VecProject : public VecIter {
+ public:
+  VecProject(VecIter *input, const vector<int> & cols);
+  ~VecProject();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  VecIter *input;
+  vector<int> cols;
+};
+
+
+// Joins outer with inner: the columns of a result batch are those of
+// outer followed by those of inner. With a key, an EQ comparison of
+// column outerKey of outer with column innerKey of inner, the inner
+// rows are found in a hash table on inner; otherwise every inner row
+// is joined. checks are comparisons of the columns of the result. All
+// of inner is read into memory by open().
+
+class VecJoin : public VecIter {
+ public:
+  VecJoin(VecIter *outer, VecIter *inner, const int outerKey,
+          const int innerKey, const vector<VecPred> & checks);
+  ~VecJoin();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  VecIter *outer;
+  VecIter *inner;
+  int outerKey, innerKey;               // -1 without a key
+  vector<VecPred> checks;
+  int outerCnt;                         // columns of outer
+
+  vector< vector<char> > innerCols;     // all of inner
+  int innerRows;
+  vector<int> heads, chain;             // hash table on innerKey
+  unsigned int mask;
+
+  Batch outerBatch;                     // the outer rows being joined
+  bool outerDone;
+  int pos, outerSel;                    // outer row being joined
+  int cand;                             // next inner row to try, or -1
+  vector<unsigned int> hashes;          // of the outer rows
+  vector<int> outerRow, innerRow;       // rows of the result batch
+  vector< vector<char> > cols;          // the result batch
+  vector<int> sel[2];
+
+  int firstCand(const int p) const;
+  template <class T> int probe();
+};
+
+
+// The rows of input ordered on the columns keys, descending where desc
+// is set. All of input is read into memory by open().
+
+class VecSort : public VecIter {
+ public:
+  VecSort(VecIter *input, const vector<int> & keys,
+          const vector<bool> & desc);
+  ~VecSort();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  VecIter *input;
+  vector<int> keys;
+  vector<bool> desc;
+  vector< vector<char> > all;           // all of input
+  vector<int> order;                    // rows of all, sorted
+  unsigned int pos;
+  vector< vector<char> > cols;
+};
+
+
+// An aggregate of the column col (-1 for count(*)).
+
+struct VecAgg {
+  AggFunc func;
+  int col;
+};
+
+// One row per group of the rows of input with the same values in the
+// columns groups, holding those values followed by the aggregates aggs;
+// schema describes the result. Without groups all the rows of input
+// form one group. The groups are formed by open(), in the order their
+// first rows come in.
+
+class VecGroup : public VecIter {
+ public:
+  VecGroup(VecIter *input, const vector<int> & groups,
+           const vector<VecAgg> & aggs, const vector<AttrDesc> & schema);
+  ~VecGroup();
+
+  const Status open();
+  const Status next(Batch & batch);
+  const Status close();
+
+ private:
+  VecIter *input;
+  vector<int> groups;
+  vector<VecAgg> aggs;
+
+  int groupCnt;
+  vector< vector<char> > cols;          // a row per group
+  vector<int> counts;
+  vector< vector<double> > sums;        // for SUM and AVG
+  vector<int> slots;                    // hash table on the groups
+  vector<unsigned int> groupHash;
+  unsigned int mask;
+  int pos;
+
+  void addGroups(const Batch & batch, const int *rows, const int n,
+                 int *gid);
+  bool sameGroup(const Batch & batch, const int row, const int g) const;
+};
+
+
+// The rows of a vectorized plan as records, the attributes of column
+// cols[i] of plan being attribute i of the records. Owns plan.
+
+class VecRowIter : public Iterator {
+ public:
+  VecRowIter(VecIter *plan, const vector<int> & cols);
+  ~VecRowIter();
+
+  const Status open();
+  const Status next(Record & rec);
+  const Status close();
+  VecIter *vectorize(const vector<bool> & needed, vector<int> & colOf,
+                     Status & status) const;
+
+ private:
+  VecIter *plan;
+  vector<int> cols;
+  Batch batch;
+  int pos;
+  vector<char> data;
+};
+
+
+// The vectorized plan of a plan of row iterators, returning the same
+// records as plan.
+
+Iterator *EX_Vectorize(const Iterator *plan, Status & status);
+
+#endif